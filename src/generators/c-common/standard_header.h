@@ -1,5 +1,8 @@
 #include <stdlib.h>
 #include <string.h>
+#ifdef PGS_COMPACT_TOKENS
+#include <stdint.h>
+#endif
 
 /**
  * Converts a nonterminal value to a string.
@@ -43,7 +46,13 @@ enum pgs_error_e {
     /** A tree couldn't be recognized.  */
     PGS_BAD_TOKEN,
     /** End of file reached where it was not expected */
-    PGS_EOF_SHIFT
+    PGS_EOF_SHIFT,
+    /** An input file couldn't be opened or read. */
+    PGS_FILE,
+    /** The input is too long to be described by the token offsets. */
+    PGS_TOO_LONG,
+    /** A parser callback asked for parsing to stop. */
+    PGS_ABORTED
 };
 
 /**
@@ -72,17 +81,70 @@ void pgs_state_init(pgs_state* s);
  */
 void pgs_state_error(pgs_state* s, pgs_error err, const char* message);
 
+/* == Source Definitions == */
+/**
+ * A length-delimited piece of text to be parsed. The text
+ * may contain NUL bytes, and need not be NUL-terminated.
+ */
+struct pgs_source_s {
+    /** The text data. */
+    const char* data;
+    /** The number of bytes in the text. */
+    size_t length;
+    /**
+     * Whether the data was mapped into memory by pgs_source_map,
+     * and needs to be released by pgs_source_unmap.
+     */
+    int mapped;
+};
+
+typedef struct pgs_source_s pgs_source;
+
+/**
+ * Maps the contents of a file into memory, using mmap where it is available.
+ * @param s the state to populate with error text, if necessary.
+ * @param source the source to initialize.
+ * @param path the path of the file to map.
+ * @return the error, if any, that occured during this process.
+ */
+pgs_error pgs_source_map(pgs_state* s, pgs_source* source, const char* path);
+/**
+ * Releases a source initialized by pgs_source_map. Tokens and trees
+ * that refer to the source's text should not be used to read it after this call.
+ * @param source the source to release.
+ */
+void pgs_source_unmap(pgs_source* source);
+
 /* == Lexing Definitions ==*/
+#ifdef PGS_COMPACT_TOKENS
+/*
+ * Compact tokens are stored in a structure-of-arrays token list,
+ * with 32-bit offsets and 16- or 32-bit terminal IDs (depending
+ * on the value of PGS_COMPACT_TOKENS).
+ */
+#if PGS_COMPACT_TOKENS == 16
+typedef uint16_t pgs_terminal_id;
+#else
+typedef uint32_t pgs_terminal_id;
+#endif
+typedef uint32_t pgs_offset;
+#define PGS_MAX_OFFSET UINT32_MAX
+#else
+typedef long int pgs_terminal_id;
+typedef size_t pgs_offset;
+#define PGS_MAX_OFFSET ((size_t) -1)
+#endif
+
 /**
  * A token produced by lexing.
  */
 struct pgs_token_s {
     /** The ID of the terminal. */
-    long int terminal;
+    pgs_terminal_id terminal;
     /** The index at which the token starts. */
-    size_t from;
+    pgs_offset from;
     /** The index at which the next token begins. */
-    size_t to;
+    pgs_offset to;
 };
 
 /**
@@ -93,8 +155,17 @@ struct pgs_token_list_s {
     size_t capacity;
     /** The number of tokens in the list. */
     size_t token_count;
+#ifdef PGS_COMPACT_TOKENS
+    /** The terminal IDs of the tokens. */
+    pgs_terminal_id* terminals;
+    /** The indices at which the tokens start. */
+    pgs_offset* froms;
+    /** The indices at which the tokens following each token begin. */
+    pgs_offset* tos;
+#else
     /** The token data array. */
     struct pgs_token_s* tokens;
+#endif
 };
 
 typedef struct pgs_token_s pgs_token;
@@ -113,13 +184,24 @@ pgs_error pgs_token_list_init(pgs_token_list* l);
  * @param to the index at which the next token begins.
  */
 pgs_error pgs_token_list_append(pgs_token_list* l, long int terminal, size_t from, size_t to);
+#ifndef PGS_COMPACT_TOKENS
 /**
- * Returns a token at the given index.
+ * Returns a token at the given index. Not available with compact tokens,
+ * which are not stored as pgs_token structures; use pgs_token_list_get instead.
  * @param l the list to return a token from.
  * @param i the index from which to return a token.
  * @return a token, or NULL if the index is out of bounds.
  */
 pgs_token* pgs_token_list_at(pgs_token_list* l, size_t i);
+#endif
+/**
+ * Copies the token at the given index.
+ * @param l the list to copy a token from.
+ * @param i the index from which to copy a token.
+ * @param into the token to copy into.
+ * @return 1 if a token was copied, or 0 if the index is out of bounds.
+ */
+int pgs_token_list_get(pgs_token_list* l, size_t i, pgs_token* into);
 /**
  * Returns a token ID at the given index.
  * @param l the list to return an ID from.
@@ -141,4 +223,14 @@ void pgs_token_list_free(pgs_token_list* l);
  * @return the error, if any, that occured during this process.
  */
 pgs_error pgs_do_lex(pgs_state* s, pgs_token_list* list, const char* source);
+/**
+ * Performs a lexing operation on a length-delimited string,
+ * which may contain NUL bytes.
+ * @param s the state to populate with error text, if necessary.
+ * @param list the list of tokens to initialize and populate.
+ * @param source the string to lex.
+ * @param length the number of bytes in the string.
+ * @return the error, if any, that occured during this process.
+ */
+pgs_error pgs_do_lex_n(pgs_state* s, pgs_token_list* list, const char* source, size_t length);
 
@@ -1,5 +1,13 @@
 #include <stdlib.h>
 #include <string.h>
+#include <stdio.h>
+#if defined(__unix__) || defined(__APPLE__)
+#define PGS_USE_MMAP
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
 
 /* == General Code == */
 
@@ -13,8 +21,148 @@ void pgs_state_error(pgs_state* s, pgs_error e, const char* message) {
     strncpy(s->errbuff, message, PGS_MAX_ERROR_LENGTH);
 }
 
+/* == Source Code == */
+
+pgs_error pgs_source_map(pgs_state* s, pgs_source* source, const char* path) {
+#ifdef PGS_USE_MMAP
+    struct stat file_stat;
+    void* data;
+    int fd = open(path, O_RDONLY);
+
+    if(fd == -1 || fstat(fd, &file_stat) == -1) {
+        if(fd != -1) close(fd);
+        pgs_state_error(s, PGS_FILE, "Unable to open input file");
+        return PGS_FILE;
+    }
+
+    source->length = (size_t) file_stat.st_size;
+    source->mapped = 0;
+    source->data = "";
+    /* mmap refuses empty mappings, but an empty file is still valid input. */
+    if(source->length > 0) {
+        data = mmap(NULL, source->length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(data == MAP_FAILED) {
+            close(fd);
+            pgs_state_error(s, PGS_FILE, "Unable to map input file");
+            return PGS_FILE;
+        }
+#ifdef MADV_SEQUENTIAL
+        madvise(data, source->length, MADV_SEQUENTIAL);
+#endif
+        source->data = (const char*) data;
+        source->mapped = 1;
+    }
+    close(fd);
+
+    return PGS_NONE;
+#else
+    char* data;
+    long int length;
+    FILE* file = fopen(path, "rb");
+
+    if(file == NULL ||
+            fseek(file, 0, SEEK_END) ||
+            (length = ftell(file)) < 0 ||
+            fseek(file, 0, SEEK_SET)) {
+        if(file) fclose(file);
+        pgs_state_error(s, PGS_FILE, "Unable to open input file");
+        return PGS_FILE;
+    }
+
+    data = (char*) malloc(length ? length : 1);
+    if(data == NULL) {
+        fclose(file);
+        pgs_state_error(s, PGS_MALLOC, "Failure to allocate memory while reading input file");
+        return PGS_MALLOC;
+    }
+    if(fread(data, 1, length, file) != (size_t) length) {
+        free(data);
+        fclose(file);
+        pgs_state_error(s, PGS_FILE, "Unable to read input file");
+        return PGS_FILE;
+    }
+    fclose(file);
+
+    source->data = data;
+    source->length = (size_t) length;
+    source->mapped = 1;
+
+    return PGS_NONE;
+#endif
+}
+
+void pgs_source_unmap(pgs_source* source) {
+    if(!source->mapped) return;
+#ifdef PGS_USE_MMAP
+    munmap((void*) source->data, source->length);
+#else
+    free((void*) source->data);
+#endif
+    source->mapped = 0;
+}
+
 /* == Lexing Code == */
 
+#ifdef PGS_COMPACT_TOKENS
+pgs_error pgs_token_list_init(pgs_token_list* l) {
+    l->capacity = 8;
+    l->token_count = 0;
+    l->terminals = (pgs_terminal_id*) malloc(sizeof(*(l->terminals)) * l->capacity);
+    l->froms = (pgs_offset*) malloc(sizeof(*(l->froms)) * l->capacity);
+    l->tos = (pgs_offset*) malloc(sizeof(*(l->tos)) * l->capacity);
+
+    if(l->terminals == NULL || l->froms == NULL || l->tos == NULL) {
+        pgs_token_list_free(l);
+        return PGS_MALLOC;
+    }
+    return PGS_NONE;
+}
+
+pgs_error pgs_token_list_append(pgs_token_list* l, long int terminal, size_t from, size_t to) {
+    if(l->capacity == l->token_count) {
+        pgs_terminal_id* new_terminals;
+        pgs_offset* new_froms;
+        pgs_offset* new_tos;
+
+        new_terminals = (pgs_terminal_id*) realloc(l->terminals, sizeof(*new_terminals) * l->capacity * 2);
+        if(new_terminals == NULL) return PGS_MALLOC;
+        l->terminals = new_terminals;
+        new_froms = (pgs_offset*) realloc(l->froms, sizeof(*new_froms) * l->capacity * 2);
+        if(new_froms == NULL) return PGS_MALLOC;
+        l->froms = new_froms;
+        new_tos = (pgs_offset*) realloc(l->tos, sizeof(*new_tos) * l->capacity * 2);
+        if(new_tos == NULL) return PGS_MALLOC;
+        l->tos = new_tos;
+        l->capacity *= 2;
+    }
+
+    l->terminals[l->token_count] = (pgs_terminal_id) terminal;
+    l->froms[l->token_count] = (pgs_offset) from;
+    l->tos[l->token_count] = (pgs_offset) (to + 1);
+    l->token_count++;
+
+    return PGS_NONE;
+}
+
+int pgs_token_list_get(pgs_token_list* l, size_t i, pgs_token* into) {
+    if(i >= l->token_count) return 0;
+    into->terminal = l->terminals[i];
+    into->from = l->froms[i];
+    into->to = l->tos[i];
+    return 1;
+}
+
+long int pgs_token_list_at_id(pgs_token_list* l, size_t i) {
+    if(i < l->token_count) return l->terminals[i];
+    return 0;
+}
+
+void pgs_token_list_free(pgs_token_list* l) {
+    free(l->terminals);
+    free(l->froms);
+    free(l->tos);
+}
+#else
 pgs_error pgs_token_list_init(pgs_token_list* l) {
     l->capacity = 8;
     l->token_count = 0;
@@ -45,6 +193,12 @@ pgs_token* pgs_token_list_at(pgs_token_list* l, size_t i) {
     return (i < l->token_count) ? &l->tokens[i] : NULL;
 }
 
+int pgs_token_list_get(pgs_token_list* l, size_t i, pgs_token* into) {
+    if(i >= l->token_count) return 0;
+    *into = l->tokens[i];
+    return 1;
+}
+
 long int pgs_token_list_at_id(pgs_token_list* l, size_t i) {
     if(i < l->token_count) return l->tokens[i].terminal;
     return 0;
@@ -53,8 +207,13 @@ long int pgs_token_list_at_id(pgs_token_list* l, size_t i) {
 void pgs_token_list_free(pgs_token_list* l) {
     free(l->tokens);
 }
+#endif
 
 pgs_error pgs_do_lex(pgs_state* s, pgs_token_list* list, const char* source) {
+    return pgs_do_lex_n(s, list, source, strlen(source));
+}
+
+pgs_error pgs_do_lex_n(pgs_state* s, pgs_token_list* list, const char* source, size_t length) {
     pgs_error error;
     size_t index = 0;
     long int final;
@@ -62,8 +221,12 @@ pgs_error pgs_do_lex(pgs_state* s, pgs_token_list* list, const char* source) {
     long int last_final_index;
     long int last_start;
     long int state;
-    size_t length = strlen(source);
 
+    /* The offset one past the end of the last token must fit into a pgs_offset. */
+    if(length >= PGS_MAX_OFFSET) {
+        pgs_state_error(s, PGS_TOO_LONG, "Input is too long");
+        return PGS_TOO_LONG;
+    }
     if((error = pgs_token_list_init(list))) return error;
     while(!error && index < length) {
         last_final = -1;
@@ -72,7 +235,7 @@ pgs_error pgs_do_lex(pgs_state* s, pgs_token_list* list, const char* source) {
         state = 1;
 
         while(index < length && state) {
-            state = lexer_state_table[state][(unsigned int) source[index]];
+            state = lexer_state_table[state][(unsigned char) source[index]];
 
             if((final = lexer_final_table[state])) {
                 last_final = final;
@@ -89,6 +252,7 @@ pgs_error pgs_do_lex(pgs_state* s, pgs_token_list* list, const char* source) {
 
     if(error == PGS_MALLOC) {
         pgs_token_list_free(list);
+        return error;
     } else if (index != length) {
         pgs_state_error(s, PGS_BAD_CHARACTER, "Invalid character at position");
         pgs_token_list_free(list);
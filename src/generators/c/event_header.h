@@ -0,0 +1,106 @@
+/* == Parsing Definitions == */
+/**
+ * The functions called by the parser as it recognizes the input.
+ * Rather than building a tree, the parser reports each token it shifts
+ * and each item it reduces, in the order a tree would be built bottom-up.
+ * Either function may be NULL, in which case that event is ignored.
+ */
+struct pgs_callbacks_s {
+    /** User data, passed as the first argument to every callback. */
+    void* user;
+    /**
+     * Called when a token is shifted onto the parse stack.
+     * The token is only valid for the duration of the call.
+     * Returning a nonzero value stops the parse with PGS_ABORTED.
+     */
+    int (*shift)(void* user, pgs_token* token);
+    /**
+     * Called when the last child_count shifted tokens and reduced
+     * nonterminals are combined into the given nonterminal, using
+     * the item with the given ID (the order of the grammar's rule alternatives).
+     * Returning a nonzero value stops the parse with PGS_ABORTED.
+     */
+    int (*reduce)(void* user, long int item_id, long int nonterminal, size_t child_count);
+};
+
+/**
+ * A parse stack. Since no tree is built, only
+ * the states of the PDA automaton are kept on it.
+ */
+struct pgs_parse_stack_s {
+    /** The number of states currently allocated. */
+    size_t capacity;
+    /** The current number of states. */
+    size_t size;
+    /** The state array. */
+    long int* data;
+};
+
+typedef struct pgs_callbacks_s pgs_callbacks;
+typedef struct pgs_parse_stack_s pgs_parse_stack;
+
+/**
+ * Initialzies a parse stack.
+ * @param s the parse stack to initialize.
+ * @return the result of the initialization.
+ */
+pgs_error pgs_parse_stack_init(pgs_parse_stack* s);
+/**
+ * Appends (pushes) a new state to the stack.
+ * @param s the stack to append to.
+ * @param state the state to append.
+ * @return the result of the append.
+ */
+pgs_error pgs_parse_stack_append(pgs_parse_stack* s, long int state);
+/**
+ * Gets the state on the top of the stack.
+ * @param s the stack for which to get a state.
+ * @return the state on the top of the stack.
+ */
+long int pgs_parse_stack_top_state(pgs_parse_stack* s);
+/**
+ * Frees a parse stack.
+ * @param s the stack to free.
+ */
+void pgs_parse_stack_free(pgs_parse_stack* s);
+/**
+ * Takes the given tokens, and attempts to recognize them,
+ * calling the given callbacks for each shift and reduce.
+ * @param s the state used for storing errors.
+ * @param list the list of tokens, already filled.
+ * @param callbacks the callbacks to call.
+ * @return the error, if any, that occured.
+ */
+pgs_error pgs_do_parse(pgs_state* s, pgs_token_list* list, const pgs_callbacks* callbacks);
+
+/* == Glue == */
+/**
+ * Attempts to parse tokens from the given string, calling the given callbacks.
+ * @param state the state to initialize with error information, if necessary.
+ * @param callbacks the callbacks to call.
+ * @param string the string from which to read.
+ * @return the error, if any, that occured.
+ */
+pgs_error pgs_do_all(pgs_state* state, const pgs_callbacks* callbacks, const char* string);
+/**
+ * Attempts to parse tokens from the given length-delimited string, calling the given callbacks.
+ * The string may contain NUL bytes.
+ * @param state the state to initialize with error information, if necessary.
+ * @param callbacks the callbacks to call.
+ * @param string the string from which to read.
+ * @param length the number of bytes in the string.
+ * @return the error, if any, that occured.
+ */
+pgs_error pgs_do_all_n(pgs_state* state, const pgs_callbacks* callbacks, const char* string, size_t length);
+/**
+ * Maps the given file into memory, and attempts to parse tokens from it, calling the given callbacks.
+ * The callbacks can read the text of a token from source->data. As with the tree parser,
+ * the source remains mapped after a successful parse, and should be released using
+ * pgs_source_unmap once the text is no longer needed.
+ * @param state the state to initialize with error information, if necessary.
+ * @param source the source to initialize with the file's contents.
+ * @param callbacks the callbacks to call.
+ * @param path the path of the file from which to read.
+ * @return the error, if any, that occured.
+ */
+pgs_error pgs_do_all_file(pgs_state* state, pgs_source* source, const pgs_callbacks* callbacks, const char* path);
@@ -0,0 +1,126 @@
+/* == Parsing Code == */
+
+pgs_error pgs_parse_stack_init(pgs_parse_stack* s) {
+    s->capacity = 8;
+    s->size = 1;
+    s->data = (long int*) malloc(sizeof(*(s->data)) * s->capacity);
+
+    if(s->data == NULL) return PGS_MALLOC;
+    s->data[0] = 1;
+
+    return PGS_NONE;
+}
+
+pgs_error pgs_parse_stack_append(pgs_parse_stack* s, long int state) {
+    if(s->capacity == s->size) {
+        long int* new_data =
+            (long int*) realloc(s->data, sizeof(*new_data) * s->capacity * 2);
+        if(new_data == NULL) return PGS_MALLOC;
+        s->capacity *= 2;
+        s->data = new_data;
+    }
+
+    s->data[s->size++] = state;
+
+    return PGS_NONE;
+}
+
+long int pgs_parse_stack_top_state(pgs_parse_stack* s) {
+    return s->data[s->size - 1];
+}
+
+void pgs_parse_stack_free(pgs_parse_stack* s) {
+    free(s->data);
+}
+
+#define PGS_PARSE_ERROR(label_name, error_name, code, text) \
+    error_name = code; \
+    pgs_state_error(s, error_name, text); \
+    goto label_name;
+
+pgs_error pgs_do_parse(pgs_state* s, pgs_token_list* list, const pgs_callbacks* callbacks) {
+    pgs_error error;
+    pgs_parse_stack stack;
+    long int top_state;
+    long int current_token_id;
+    long int action;
+    long int nonterminal;
+    pgs_token current_token;
+    size_t index = 0;
+
+    if((error = pgs_parse_stack_init(&stack))) return error;
+    while(1) {
+        current_token_id = pgs_token_list_at_id(list, index);
+        top_state = pgs_parse_stack_top_state(&stack);
+        action = parse_action_table[top_state][current_token_id];
+
+        if(action == -1) {
+            PGS_PARSE_ERROR(error_label, error, PGS_BAD_TOKEN, "Unexpected token at position");
+        } else if(action == 0) {
+            if(!pgs_token_list_get(list, index, &current_token)) {
+                PGS_PARSE_ERROR(error_label, error, PGS_EOF_SHIFT, "Unexpected end of file");
+            }
+            if(callbacks->shift && callbacks->shift(callbacks->user, &current_token)) {
+                PGS_PARSE_ERROR(error_label, error, PGS_ABORTED, "Parsing stopped by shift callback");
+            }
+
+            error = pgs_parse_stack_append(&stack, parse_state_table[top_state][current_token_id]);
+            if(error) goto error_label;
+            index++;
+        } else {
+            nonterminal = items[action - 1].left_id;
+            if(callbacks->reduce &&
+                    callbacks->reduce(callbacks->user, action - 1, nonterminal, items[action - 1].right_count)) {
+                PGS_PARSE_ERROR(error_label, error, PGS_ABORTED, "Parsing stopped by reduce callback");
+            }
+
+            if(parse_final_table[nonterminal + 1]) break;
+            stack.size -= items[action - 1].right_count;
+            top_state = pgs_parse_stack_top_state(&stack);
+            error = pgs_parse_stack_append(&stack, parse_state_table[top_state][nonterminal + 2 + PGS_MAX_TERMINAL]);
+            if(error) goto error_label;
+        }
+    }
+
+    if(index != list->token_count) {
+        PGS_PARSE_ERROR(error_label, error, PGS_BAD_TOKEN, "Unexpected token at position");
+    }
+
+    error_label:
+    pgs_parse_stack_free(&stack);
+    return error;
+}
+
+/* == Glue Code == */
+pgs_error pgs_do_all(pgs_state* state, const pgs_callbacks* callbacks, const char* string) {
+    return pgs_do_all_n(state, callbacks, string, strlen(string));
+}
+
+pgs_error pgs_do_all_n(pgs_state* state, const pgs_callbacks* callbacks, const char* string, size_t length) {
+    pgs_error error;
+    pgs_token_list tokens;
+    pgs_state_init(state);
+    if((error = pgs_do_lex_n(state, &tokens, string, length))) {
+        if(error == PGS_MALLOC) {
+            pgs_state_error(state, error, "Failure to allocate memory while lexing");
+        }
+        return error;
+    }
+    if((error = pgs_do_parse(state, &tokens, callbacks))) {
+        if(error == PGS_MALLOC) {
+            pgs_state_error(state, error, "Failure to allocate memory while parsing");
+        }
+    }
+    pgs_token_list_free(&tokens);
+    return error;
+}
+
+pgs_error pgs_do_all_file(pgs_state* state, pgs_source* source, const pgs_callbacks* callbacks, const char* path) {
+    pgs_error error;
+    pgs_state_init(state);
+    if((error = pgs_source_map(state, source, path))) return error;
+    if((error = pgs_do_all_n(state, callbacks, source->data, source->length))) {
+        pgs_source_unmap(source);
+    }
+    return error;
+}
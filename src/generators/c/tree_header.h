@@ -197,3 +197,24 @@ pgs_error pgs_do_parse(pgs_state* s, pgs_token_list* list, pgs_tree** into);
  * @return the error, if any, that occured.
  */
 pgs_error pgs_do_all(pgs_state* state, pgs_tree** into, const char* string);
+/**
+ * Attempts to parse tokens from the given length-delimited string into the given tree.
+ * The string may contain NUL bytes.
+ * @param state the state to initialize with error information, if necessary.
+ * @param into the tree to build into.
+ * @param string the string from which to read.
+ * @param length the number of bytes in the string.
+ * @return the error, if any, that occured.
+ */
+pgs_error pgs_do_all_n(pgs_state* state, pgs_tree** into, const char* string, size_t length);
+/**
+ * Maps the given file into memory, and attempts to parse tokens from it into the given tree.
+ * Since the tree refers to the file's text, the source remains mapped after a successful
+ * parse, and should be released using pgs_source_unmap once the tree is no longer needed.
+ * @param state the state to initialize with error information, if necessary.
+ * @param source the source to initialize with the file's contents.
+ * @param into the tree to build into.
+ * @param path the path of the file from which to read.
+ * @return the error, if any, that occured.
+ */
+pgs_error pgs_do_all_file(pgs_state* state, pgs_source* source, pgs_tree** into, const char* path);
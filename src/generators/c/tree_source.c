@@ -156,7 +156,7 @@ pgs_error pgs_do_parse(pgs_state* s, pgs_token_list* list, pgs_tree** into) {
     long int current_token_id;
     long int action;
     struct pgs_item_s* item;
-    pgs_token* current_token; 
+    pgs_token current_token;
     size_t index = 0;
     
     if((error = pgs_parse_stack_init(&stack))) return error;
@@ -175,12 +175,11 @@ pgs_error pgs_do_parse(pgs_state* s, pgs_token_list* list, pgs_tree** into) {
         if(action == -1) {
             PGS_PARSE_ERROR(error_label, error, PGS_BAD_TOKEN, "Unexpected token at position");
         } else if(action == 0) {
-            current_token = pgs_token_list_at(list, index);
-            if(index >= (list->token_count)) {
+            if(!pgs_token_list_get(list, index, &current_token)) {
                 PGS_PARSE_ERROR(error_label, error, PGS_EOF_SHIFT, "Unexpected end of file");
             }
 
-            error = pgs_parse_stack_append_terminal(&stack, current_token);
+            error = pgs_parse_stack_append_terminal(&stack, &current_token);
             if(error) goto error_label;
             index++;
         } else {
@@ -203,11 +202,15 @@ pgs_error pgs_do_parse(pgs_state* s, pgs_token_list* list, pgs_tree** into) {
 
 /* == Glue Code == */
 pgs_error pgs_do_all(pgs_state* state, pgs_tree** into, const char* string) {
+    return pgs_do_all_n(state, into, string, strlen(string));
+}
+
+pgs_error pgs_do_all_n(pgs_state* state, pgs_tree** into, const char* string, size_t length) {
     pgs_error error;
     pgs_token_list tokens;
     pgs_state_init(state);
     *into = NULL;
-    if((error = pgs_do_lex(state, &tokens, string))) {
+    if((error = pgs_do_lex_n(state, &tokens, string, length))) {
         if(error == PGS_MALLOC) {
             pgs_state_error(state, error, "Failure to allocate memory while lexing");
         }
@@ -221,3 +224,14 @@ pgs_error pgs_do_all(pgs_state* state, pgs_tree** into, const char* string) {
     pgs_token_list_free(&tokens);
     return error;
 }
+
+pgs_error pgs_do_all_file(pgs_state* state, pgs_source* source, pgs_tree** into, const char* path) {
+    pgs_error error;
+    pgs_state_init(state);
+    *into = NULL;
+    if((error = pgs_source_map(state, source, path))) return error;
+    if((error = pgs_do_all_n(state, into, source->data, source->length))) {
+        pgs_source_unmap(source);
+    }
+    return error;
+}
@@ -0,0 +1,85 @@
+/* == Lexing Definitions == */
+/**
+ * A token produced by lexing.
+ */
+struct token {
+    /** The ID of the terminal. */
+    std::uint32_t terminal;
+    /** The text of the token, which refers to the lexed source. */
+    std::string_view text;
+};
+
+/**
+ * The exception thrown when the source can't be lexed or parsed.
+ */
+class parse_error : public std::runtime_error {
+public:
+    /**
+     * Creates a new parse error.
+     * @param message the error message.
+     * @param position the index in the source at which the error occured.
+     */
+    parse_error(const char* message, std::size_t position)
+        : std::runtime_error(message), position_(position) {}
+
+    /**
+     * Gets the index in the source at which the error occured.
+     * @return the index in the source.
+     */
+    std::size_t position() const noexcept { return position_; }
+
+private:
+    std::size_t position_;
+};
+
+/**
+ * Splits the given source into tokens. The tokens' text refers
+ * to the source, which must outlive them.
+ * @param source the source to lex.
+ * @return the tokens, with skipped tokens left out.
+ */
+inline std::vector<token> lex(std::string_view source) {
+    std::vector<token> tokens;
+    std::size_t index = 0;
+
+    while(index < source.size()) {
+        std::size_t start = index;
+        std::size_t last_final = 0;
+        std::size_t last_final_end = index;
+        std::size_t state = 1;
+
+        while(index < source.size() && state) {
+            state = tables::lexer_state_table[state][static_cast<unsigned char>(source[index])];
+
+            if(tables::lexer_final_table[state]) {
+                last_final = tables::lexer_final_table[state];
+                last_final_end = index + 1;
+            }
+
+            if(state) index++;
+        }
+
+        if(!last_final) throw parse_error("Invalid character at position", index);
+        index = last_final_end;
+        if(tables::lexer_skip_table[last_final]) continue;
+        tokens.push_back(token{ static_cast<std::uint32_t>(last_final),
+                source.substr(start, last_final_end - start) });
+    }
+
+    return tokens;
+}
+
+namespace detail {
+    /**
+     * Computes the index in the source of the token at the given index,
+     * used for reporting errors.
+     * @param source the source from which the tokens were lexed.
+     * @param tokens the tokens being parsed.
+     * @param index the index of the token.
+     * @return the index in the source.
+     */
+    inline std::size_t position(std::string_view source, const std::vector<token>& tokens, std::size_t index) {
+        if(index >= tokens.size()) return source.size();
+        return static_cast<std::size_t>(tokens[index].text.data() - source.data());
+    }
+}
@@ -1,10 +1,14 @@
 /* == Glue Code == */
 
 pgs_error pgs_do_all(pgs_state* state, pgs_stack_value* into, const char* string) {
+    return pgs_do_all_n(state, into, string, strlen(string));
+}
+
+pgs_error pgs_do_all_n(pgs_state* state, pgs_stack_value* into, const char* string, size_t length) {
     pgs_error error;
     pgs_token_list tokens;
     pgs_state_init(state);
-    if((error = pgs_do_lex(state, &tokens, string))) {
+    if((error = pgs_do_lex_n(state, &tokens, string, length))) {
         if(error == PGS_MALLOC) {
             pgs_state_error(state, error, "Failure to allocate memory while lexing");
         }
@@ -19,6 +23,16 @@ pgs_error pgs_do_all(pgs_state* state, pgs_stack_value* into, const char* string
     return error;
 }
 
+pgs_error pgs_do_all_file(pgs_state* state, pgs_source* source, pgs_stack_value* into, const char* path) {
+    pgs_error error;
+    pgs_state_init(state);
+    if((error = pgs_source_map(state, source, path))) return error;
+    if((error = pgs_do_all_n(state, into, source->data, source->length))) {
+        pgs_source_unmap(source);
+    }
+    return error;
+}
+
 /* == Parsing Code == */
 
 pgs_error pgs_parse_stack_init(pgs_parse_stack* s) {